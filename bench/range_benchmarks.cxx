@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+
+#include <si/si.hxx>
+
+#include <algorithm>
+#include <iterator>
+#include <optional>
+#include <ranges>
+
+namespace {
+  auto int_range(int from, int to)
+  {
+    return si::generate([=]() mutable -> std::optional<int> {
+      if (from>to) return {};
+      return from++;
+    });
+  }
+
+  /**
+   * The adapter range-for used to go through before si::to_range() became a std::ranges::view.
+   * Kept here as the baseline the new adapter is measured against.
+   */
+  template<si::Iterator I>
+  class PreviousIteratorWrapper final {
+    mutable std::optional<I> base;
+
+    using T = decltype(std::declval<I>().next());
+    std::optional<T> value{};
+
+  public:
+    inline PreviousIteratorWrapper()
+        :base{} { }
+
+    explicit inline PreviousIteratorWrapper(I const& base)
+        :base{base}
+    {
+      auto& it = this->base.value();
+      if (it.has_next()) {
+        value = it.next();
+      }
+    }
+
+    inline bool operator!=(PreviousIteratorWrapper const& rhs) const
+    {
+      return value.has_value() ||
+          rhs.value.has_value() ||
+          (base.has_value() && base.value().has_next()) ||
+          (rhs.base.has_value() && rhs.base.value().has_next());
+    }
+
+    inline T const& operator*() const
+    {
+      if (!value.has_value()) {
+        throw si::no_such_element_exception{"Tried dereferencing end iterator."};
+      }
+
+      return value.value();
+    }
+
+    inline PreviousIteratorWrapper& operator++()
+    {
+      if (base.has_value()) {
+        value = si::maybe_next(base.value());
+      }
+      return *this;
+    }
+  };
+
+  template<si::Iterator I>
+  struct PreviousRange {
+    I iterator;
+
+    inline auto begin() const
+    {
+      return PreviousIteratorWrapper<I>{iterator};
+    }
+
+    inline auto end() const
+    {
+      return PreviousIteratorWrapper<I>{};
+    }
+  };
+}
+
+static void ManualLoop(benchmark::State& state)
+{
+  auto const n = static_cast<int>(state.range(0));
+  for (auto _: state) {
+    auto it = (int_range(1, n) << si::map([](int m) { return m*2; })).iterator();
+    long sum = 0;
+    while (it.has_next()) {
+      sum += it.next();
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+BENCHMARK(ManualLoop)->Range(1 << 10, 1 << 16);
+
+static void RangeForPrevious(benchmark::State& state)
+{
+  auto const n = static_cast<int>(state.range(0));
+  for (auto _: state) {
+    auto const iterable = int_range(1, n) << si::map([](int m) { return m*2; });
+    long sum = 0;
+    for (int m: PreviousRange<decltype(iterable.iterator())>{iterable.iterator()}) {
+      sum += m;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+BENCHMARK(RangeForPrevious)->Range(1 << 10, 1 << 16);
+
+static void RangeFor(benchmark::State& state)
+{
+  auto const n = static_cast<int>(state.range(0));
+  for (auto _: state) {
+    long sum = 0;
+    for (int m: int_range(1, n) << si::map([](int m) { return m*2; }) << si::to_range()) {
+      sum += m;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+BENCHMARK(RangeFor)->Range(1 << 10, 1 << 16);
+
+static void RangesAlgorithm(benchmark::State& state)
+{
+  auto const n = static_cast<int>(state.range(0));
+  for (auto _: state) {
+    long sum = 0;
+    std::ranges::for_each(int_range(1, n) << si::map([](int m) { return m*2; }) << si::to_range(),
+        [&sum](int m) { sum += m; });
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations()*state.range(0));
+}
+
+BENCHMARK(RangesAlgorithm)->Range(1 << 10, 1 << 16);
@@ -4,9 +4,21 @@
 #define SI_ALGORITHMS_COLLECT_HXX
 
 #include "../iterable.hxx"
+#include "../range.hxx"
+
+#include <iterator>
 
 namespace si {
   namespace detail {
+    template<typename Container, Iterable I>
+    inline Container collect_into(I const& i)
+    {
+      using CommonIterator = std::common_iterator<IteratorWrapper<decltype(i.iterator())>, std::default_sentinel_t>;
+
+      Range range{i.iterator()};
+      return Container{CommonIterator{range.begin()}, CommonIterator{std::default_sentinel}};
+    }
+
     struct UntypedCollect final {
     };
 
@@ -23,8 +35,7 @@ namespace si {
       template<typename Container>
       operator Container() const
       {
-        using Iterator = decltype(iterable.iterator());
-        return Container{IteratorWrapper{iterable.iterator()}, IteratorWrapper<Iterator>{}};
+        return collect_into<Container>(iterable);
       }
     };
 
@@ -41,8 +52,7 @@ namespace si {
     template<Iterable I, typename Container>
     inline Container operator<<(I const& i, TypedCollect<Container>)
     {
-      using Iterator = decltype(i.iterator());
-      return Container{IteratorWrapper{i.iterator()}, IteratorWrapper<Iterator>{}};
+      return collect_into<Container>(i);
     }
   }
 
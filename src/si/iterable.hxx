@@ -7,7 +7,10 @@
 #include "iterator.hxx"
 
 #include <iterator>
+#include <memory>
+#include <ranges>
 #include <type_traits>
+#include <utility>
 
 namespace si {
   template<typename T>
@@ -22,6 +25,11 @@ namespace si {
   };
 
   namespace detail {
+    // borrowed common views can safely go through the legacy wrapper, all others need to be kept alive
+    template<typename T>
+    concept StatefulView = std::ranges::view<T> &&
+        !(LegacyIterable<T> && std::ranges::borrowed_range<T> && std::ranges::common_range<T const>);
+
     template<typename LegacyIterator>
     class LegacyIterableWrappingIterator final {
       using ValueType = typename std::iterator_traits<LegacyIterator>::value_type;
@@ -61,6 +69,55 @@ namespace si {
         return LegacyIterableWrappingIterator{begin, end};
       }
     };
+
+    template<std::ranges::input_range View>
+    class ViewWrappingIterator final {
+      using ValueType = std::ranges::range_value_t<View>;
+
+      std::shared_ptr<View> view;
+      std::ranges::iterator_t<View> begin;
+      std::ranges::sentinel_t<View> end;
+
+    public:
+      explicit inline ViewWrappingIterator(std::shared_ptr<View> const& view)
+          :view{view}, begin{std::ranges::begin(*view)}, end{std::ranges::end(*view)} { }
+
+      [[nodiscard]] inline bool has_next() const
+      {
+        return begin!=end;
+      }
+
+      inline ValueType next()
+      {
+        if (!has_next())
+          throw si::no_such_element_exception{"Called next() on view end iterator."};
+
+        ValueType value = *begin;
+        ++begin;
+        return value;
+      }
+    };
+
+    /**
+     * The view is shared by all iterators and all copies of the wrapper,
+     * as iterators of e.g. std::ranges::filter_view point into their view.
+     * That is the trade-off against the value semantics of the other iterables:
+     * views caching begin() (like std::ranges::filter_view) must not be iterated from several threads at once,
+     * and input-only views are consumed once, no matter how often iterator() is called.
+     */
+    template<std::ranges::input_range View>
+    class ViewWrapper final {
+      std::shared_ptr<View> view;
+
+    public:
+      explicit inline ViewWrapper(View view)
+          :view{std::make_shared<View>(std::move(view))} { }
+
+      inline auto iterator() const
+      {
+        return ViewWrappingIterator<View>{view};
+      }
+    };
   }
 
   template<typename Iterator>
@@ -69,11 +126,19 @@ namespace si {
     return detail::LegacyIterableWrapper{begin, end};
   }
 
-  template<LegacyIterable LI>
+  template<LegacyIterable LI> requires (!detail::StatefulView<LI>)
   inline auto iterate(LI const& li)
   {
     return iterate(std::cbegin(li), std::cend(li));
   }
+
+  // si iterators get copied by the algorithms, so move-only iterators like std::ranges::istream_view's are not supported
+  template<detail::StatefulView View> requires std::ranges::input_range<View> &&
+      std::copyable<std::ranges::iterator_t<View>>
+  inline auto iterate(View view)
+  {
+    return detail::ViewWrapper<View>{std::move(view)};
+  }
 }
 
 #endif // SI_ITERABLE_HXX
@@ -5,7 +5,9 @@
 
 #include <concepts>
 #include <iterator>
+#include <memory>
 #include <optional>
+#include <utility>
 
 #include "callables.hxx"
 #include "exceptions.hxx"
@@ -26,78 +28,149 @@ namespace si {
       return {};
   }
 
-  template<Iterator I>
-  class IteratorWrapper final {
-    mutable std::optional<I> base;
-
-    using T = decltype(std::declval<I>().next());
-    std::optional<T> value{};
-
-  public:
-    using iterator_category = std::input_iterator_tag;
-    using value_type = T;
-    using difference_type = std::ptrdiff_t;
-    using pointer = T const*;
-    using reference = T const&;
-
-    inline IteratorWrapper()
-        :base{} { }
-
-    explicit inline IteratorWrapper(I const& base)
-        :base{base}
-    {
-      auto& it = this->base.value();
-      if (it.has_next()) {
-        value = it.next();
-      }
-    }
-
-    inline bool operator!=(IteratorWrapper const& rhs) const
-    {
-      return value.has_value() ||
-          rhs.value.has_value() ||
-          (base.has_value() && base.value().has_next()) ||
-          (rhs.base.has_value() && rhs.base.value().has_next());
-    }
-
-    inline bool operator==(IteratorWrapper const& rhs) const
-    {
-      return !operator!=(rhs);
-    }
-
-    inline pointer operator->() const
-    {
-      if (!value.has_value()) {
-        throw no_such_element_exception{"Tried dereferencing end iterator."};
-      }
-
-      return std::addressof(value.value());
-    }
-
-    inline reference operator*() const
-    {
-      if (!value.has_value()) {
-        throw no_such_element_exception{"Tried dereferencing end iterator."};
-      }
-
-      return value.value();
-    }
-
-    inline IteratorWrapper& operator++()
-    {
-      if (base.has_value()) {
-        value = maybe_next(base.value());
-      }
-      return *this;
-    }
-
-    inline IteratorWrapper operator++(int)
-    {
-      IteratorWrapper const old{*this};
-      ++(*this);
-      return old;
-    }
-  };
+  namespace detail {
+    /**
+     * Makes copy constructible types assignable, similar to the movable-box of std::ranges.
+     * Needed as iterators capturing lambdas are not assignable, while std::ranges requires movable iterators and views.
+     * If a copy throws during assignment the box keeps its old value, if a move throws the box is left empty.
+     */
+    template<typename T>
+    class AssignableBox final {
+      std::optional<T> value{};
+
+    public:
+      AssignableBox() = default;
+
+      explicit inline AssignableBox(T const& value)
+          :value{value} { }
+
+      AssignableBox(AssignableBox const&) = default;
+
+      AssignableBox(AssignableBox&&) = default;
+
+      inline AssignableBox& operator=(AssignableBox const& rhs)
+      {
+        if (this!=&rhs) {
+          AssignableBox copy{rhs};
+          *this = std::move(copy);
+        }
+        return *this;
+      }
+
+      inline AssignableBox& operator=(AssignableBox&& rhs)
+      {
+        if (this!=&rhs) {
+          value.reset();
+          if (rhs.value.has_value()) {
+            value.emplace(std::move(*rhs.value));
+          }
+        }
+        return *this;
+      }
+
+      template<typename... Args>
+      inline void emplace(Args&& ... args)
+      {
+        value.emplace(std::forward<Args>(args)...);
+      }
+
+      inline void reset() noexcept
+      {
+        value.reset();
+      }
+
+      [[nodiscard]] inline bool has_value() const noexcept
+      {
+        return value.has_value();
+      }
+
+      inline T& operator*() noexcept
+      {
+        return *value;
+      }
+
+      inline T const& operator*() const noexcept
+      {
+        return *value;
+      }
+
+      inline T* operator->() noexcept
+      {
+        return std::addressof(*value);
+      }
+
+      inline T const* operator->() const noexcept
+      {
+        return std::addressof(*value);
+      }
+    };
+
+    /**
+     * Adapts an si::Iterator to std::input_iterator, using std::default_sentinel_t as end.
+     * Like std::ranges::istream_view it fetches the next element on construction and on operator++,
+     * so comparing against the sentinel only tests the cached element.
+     */
+    template<Iterator I>
+    class IteratorWrapper final {
+      using T = decltype(std::declval<I&>().next());
+
+      AssignableBox<I> base{};
+      AssignableBox<T> current{};
+
+      inline void fetch()
+      {
+        if (base.has_value() && base->has_next()) {
+          current.emplace(base->next());
+        }
+        else {
+          current.reset();
+        }
+      }
+
+    public:
+      using iterator_concept = std::input_iterator_tag;
+      using value_type = T;
+      using difference_type = std::ptrdiff_t;
+
+      IteratorWrapper() = default;
+
+      explicit inline IteratorWrapper(I const& base)
+          :base{base}
+      {
+        fetch();
+      }
+
+      inline T const* operator->() const
+      {
+        return std::addressof(operator*());
+      }
+
+      inline T const& operator*() const
+      {
+        if (!current.has_value()) {
+          throw no_such_element_exception{"Tried dereferencing end iterator."};
+        }
+
+        return *current;
+      }
+
+      inline IteratorWrapper& operator++()
+      {
+        fetch();
+        return *this;
+      }
+
+      inline void operator++(int)
+      {
+        fetch();
+      }
+
+      friend inline bool operator==(IteratorWrapper const& it, std::default_sentinel_t)
+      {
+        return !it.current.has_value();
+      }
+    };
+  }
 }
 
 #endif // SI_ITERATOR_HXX
@@ -6,20 +6,31 @@
 #include "iterable.hxx"
 #include "iterator.hxx"
 
+#include <iterator>
+#include <ranges>
+
 namespace si {
   namespace detail {
+    /**
+     * std::ranges::view over an si::Iterator.
+     * Every call to begin() iterates a fresh copy of the iterator.
+     */
     template<Iterator I>
-    struct Range {
-      I iterator;
+    class Range final : public std::ranges::view_interface<Range<I>> {
+      AssignableBox<I> iterator;
+
+    public:
+      explicit inline Range(I const& iterator)
+          :iterator{iterator} { }
 
       inline auto begin() const
       {
-        return IteratorWrapper<I>{iterator};
+        return IteratorWrapper<I>{*iterator};
       }
 
-      inline auto end() const
+      inline auto end() const noexcept
       {
-        return IteratorWrapper<I>{};
+        return std::default_sentinel;
       }
     };
 
@@ -5,10 +5,14 @@
 #include <array>
 #include <cctype>
 #include <functional>
+#include <iterator>
 #include <list>
+#include <ranges>
 #include <unordered_map>
 #include <set>
+#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "config.hxx"
@@ -27,8 +31,14 @@ struct IntIterable {
 struct MissingIterator {
 };
 
+template<typename T>
+concept Iteratable = requires(T t) {
+  { si::iterate(std::move(t)) };
+};
+
 // the tests
 static_assert(si::Iterable<IntIterable>, "IntIterable should be an si::Iterable<?>");
+static_assert(!Iteratable<std::ranges::istream_view<int>>, "views with move-only iterators should be rejected");
 static_assert(!si::Iterable<MissingIterator>, "MissingIterator should not be an si::Iterable<?>");
 
 TEST(IterableTests, LegacyWrapperVector)
@@ -128,6 +138,69 @@ TEST(IterableTests, LegacyWrapperUnorderedMap)
   EXPECT_EQ(result, expected);
 }
 
+TEST(IterableTests, ViewWrapperFilter)
+{
+  std::vector const source{1, 2, 3, 4, 5, 6};
+  std::vector const expected{4, 16, 36};
+
+  auto const result = si::iterate(source | std::views::filter([](int n) { return n%2==0; }))
+      << si::map([](int n) { return n*n; })
+      << si::collect<std::vector<int>>();
+
+  EXPECT_EQ(result, expected);
+}
+
+TEST(IterableTests, ViewWrapperOwningTemporary)
+{
+  std::vector const expected{0, 2, 4, 6, 8};
+
+  auto const iterable = si::iterate(std::views::iota(0)
+      | std::views::transform([](int n) { return n*2; })
+      | std::views::take(5));
+
+  EXPECT_EQ(iterable << si::collect<std::vector<int>>(), expected);
+  EXPECT_EQ(iterable << si::count(), 5u);
+}
+
+TEST(IterableTests, ViewWrapperInputOnlyIsSinglePass)
+{
+  std::istringstream stream{"abc"};
+  auto const iterable = si::iterate(std::ranges::subrange{std::istreambuf_iterator<char>{stream}, std::default_sentinel});
+
+  EXPECT_EQ(iterable << si::count(), 3u);
+  EXPECT_EQ(iterable << si::count(), 0u);
+}
+
+TEST(IterableTests, ViewWrapperUnboundedIota)
+{
+  std::vector const expected{0, 1, 2, 3, 4};
+
+  EXPECT_EQ(si::iterate(std::views::iota(0)) << si::take(5) << si::collect<std::vector<int>>(), expected);
+  EXPECT_EQ(si::iterate(std::views::iota(0, 10L)) << si::count(), 10u);
+}
+
+TEST(IterableTests, ViewWrapperNonCommonSubrange)
+{
+  std::vector const source{1, 2, 3, 4, 5};
+  std::vector const expected{1, 2, 3};
+
+  auto const result = si::iterate(std::ranges::subrange{std::counted_iterator{source.begin(), 3}, std::default_sentinel})
+      << si::collect<std::vector<int>>();
+
+  EXPECT_EQ(result, expected);
+}
+
+TEST(IterableTests, ViewWrapperBorrowed)
+{
+  using namespace std::literals::string_view_literals;
+
+  std::string const result = si::iterate("hello world!"sv)
+      << si::map([](char c) { return std::toupper(c); })
+      << si::collect();
+
+  EXPECT_EQ(result, "HELLO WORLD!");
+}
+
 #ifndef SKIP_EXCEPTION_TESTS
 TEST(IterableTests, LegacyWrapperReadAfterEnd)
 {
@@ -137,4 +210,11 @@ TEST(IterableTests, LegacyWrapperReadAfterEnd)
   EXPECT_THROW(it.next(), si::no_such_element_exception);
 }
 
+TEST(IterableTests, ViewWrapperReadAfterEnd)
+{
+  auto const iterable = si::iterate(std::views::iota(0, 0) | std::views::filter([](int) { return true; }));
+  auto it = iterable.iterator();
+  EXPECT_THROW(it.next(), si::no_such_element_exception);
+}
+
 #endif // SKIP_EXCEPTION_TESTS
@@ -3,6 +3,8 @@
 #include <si/si.hxx>
 
 #include <cctype>
+#include <iterator>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -31,6 +33,10 @@ static_assert(si::Iterator<IntIterator>, "IntIterator should be an si::Iterator<
 static_assert(!si::Iterator<MissingNext>, "MissingNext should not be an si::Iterator<?>");
 static_assert(!si::Iterator<MissingHasNext>, "MissingHasNext should not be an si::Iterator<?>");
 static_assert(!si::Iterator<MissingAll>, "MissingAll should not be an si::Iterator<?>");
+static_assert(std::input_iterator<si::detail::IteratorWrapper<IntIterator>>,
+    "si::detail::IteratorWrapper<?> should be a std::input_iterator");
+static_assert(std::sentinel_for<std::default_sentinel_t, si::detail::IteratorWrapper<IntIterator>>,
+    "std::default_sentinel_t should be the sentinel of si::detail::IteratorWrapper<?>");
 
 TEST(IteratorTests, StringFromIteratorWrapper)
 {
@@ -83,20 +89,63 @@ struct DummyIterator {
   }
 };
 
+struct DummyIterable {
+  constexpr DummyIterator iterator() const
+  {
+    return {};
+  }
+};
+
+TEST(IteratorTests, IncrementEndIterator)
+{
+  using Wrapper = decltype((DummyIterable{} << si::to_range()).begin());
+  Wrapper end{};
+  ++end;
+  end++;
+  EXPECT_TRUE(end==std::default_sentinel);
+}
+
 #ifndef SKIP_EXCEPTION_TESTS
 TEST(IteratorTests, TryReadingFromEndIterator)
 {
-  si::IteratorWrapper<DummyIterator> end{};
+  decltype((DummyIterable{} << si::to_range()).begin()) end{};
   EXPECT_THROW(*end, si::no_such_element_exception);
   EXPECT_THROW((void) end->value, si::no_such_element_exception);
 }
 
 TEST(IteratorTests, DereferenceStructure)
 {
-  DummyIterator it;
-  si::IteratorWrapper iw{it};
+  auto const range = DummyIterable{} << si::to_range();
+  auto const iw = range.begin();
   EXPECT_EQ((*iw).value, 42);
   EXPECT_EQ(iw->value, 42);
 }
 
+TEST(IteratorTests, TryReadingFromExhaustedIterator)
+{
+  std::string const empty{};
+  auto const range = si::iterate(empty) << si::to_range();
+  auto it = range.begin();
+  EXPECT_TRUE(it==std::default_sentinel);
+  EXPECT_THROW(*it, si::no_such_element_exception);
+}
+
+TEST(IteratorTests, ExceptionsPassThroughRangeFor)
+{
+  std::vector const source{1, 2, 3, 4, 5};
+  auto const throwing = si::iterate(source)
+      << si::filter([](int n) {
+        if (n==3) throw std::runtime_error{"3 is not welcome"};
+        return true;
+      });
+
+  std::vector<int> results;
+  EXPECT_THROW({
+    for (int n: throwing << si::to_range()) {
+      results.push_back(n);
+    }
+  }, std::runtime_error);
+  EXPECT_EQ(results, (std::vector{1, 2}));
+}
+
 #endif // SKIP_EXCEPTION_TESTS
@@ -2,6 +2,8 @@
 
 #include <si/si.hxx>
 
+#include <algorithm>
+#include <ranges>
 #include <vector>
 
 #include "config.hxx"
@@ -16,6 +18,10 @@ namespace {
   }
 }
 
+using IntRange = decltype(int_range(0, 0) << si::to_range());
+static_assert(std::ranges::input_range<IntRange>, "si::to_range() should produce a std::ranges::input_range");
+static_assert(std::ranges::view<IntRange>, "si::to_range() should produce a std::ranges::view");
+
 TEST(RangeTests, RangeBasedFor)
 {
   int n = 0;
@@ -24,6 +30,35 @@ TEST(RangeTests, RangeBasedFor)
   }
 }
 
+TEST(RangeTests, ConstRange)
+{
+  std::vector const expected{1, 2, 3};
+  std::vector<int> results;
+
+  auto const range = si::iterate(expected) << si::to_range();
+  for (int n: range) {
+    results.push_back(n);
+  }
+
+  EXPECT_EQ(expected, results);
+}
+
+TEST(RangeTests, RestartsOnBegin)
+{
+  auto const range = int_range(1, 5) << si::to_range();
+  std::vector<int> results;
+
+  for (int n: range) {
+    results.push_back(n);
+    if (n==2) break;
+  }
+  for (int n: range) {
+    results.push_back(n);
+  }
+
+  EXPECT_EQ(results, (std::vector{1, 2, 1, 2, 3, 4, 5}));
+}
+
 TEST(RangeTests, Recursion)
 {
   std::vector const expected{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
@@ -35,3 +70,41 @@ TEST(RangeTests, Recursion)
 
   EXPECT_EQ(expected, results);
 }
+
+TEST(RangeTests, RangesAlgorithms)
+{
+  auto range = int_range(1, 10) << si::to_range();
+  auto const it = std::ranges::find(range, 5);
+
+  ASSERT_NE(it, std::default_sentinel);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(std::ranges::count_if(int_range(1, 10) << si::to_range(), [](int n) { return n%3==0; }), 3);
+}
+
+TEST(RangeTests, RangesViews)
+{
+  std::vector const expected{4, 16, 36};
+  std::vector<int> results;
+
+  auto squares_of_evens = int_range(1, 7) << si::to_range()
+      | std::views::filter([](int n) { return n%2==0; })
+      | std::views::transform([](int n) { return n*n; });
+
+  for (int n: squares_of_evens) {
+    results.push_back(n);
+  }
+
+  EXPECT_EQ(expected, results);
+}
+
+TEST(RangeTests, RangesDrop)
+{
+  std::vector const expected{4, 5, 6};
+  std::vector<int> results;
+
+  for (int n: int_range(1, 6) << si::to_range() | std::views::drop(3)) {
+    results.push_back(n);
+  }
+
+  EXPECT_EQ(expected, results);
+}